@@ -71,3 +71,19 @@ $O/%unittests: override LDFLAGS += -lglib-2.0 -lpcre -lxml2 -lxslt -lebtree \
 ifdef CI
 $O/%unittests: override DFLAGS += -cov
 endif
+
+# Benchmarks: each benchmark/<name>/main.d is built as an optimised binary
+# $O/bench-<name>; `make bench` runs them all and stores their JSON output
+# in $O/bench-<name>.json, to be compared against an earlier run.
+BENCHMARKS := $(patsubst $C/benchmark/%/main.d,%,\
+		$(wildcard $C/benchmark/*/main.d))
+
+$O/bench-%: override DFLAGS += -release -O -inline
+$O/bench-%: override LDFLAGS += -lebtree
+
+$O/bench-%: $C/benchmark/%/main.d
+	$(call build_d)
+
+.PHONY: bench
+bench: $(BENCHMARKS:%=$O/bench-%)
+	$(foreach b,$(BENCHMARKS),$O/bench-$b > $O/bench-$b.json &&) true